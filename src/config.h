@@ -6,12 +6,33 @@
 #define MOONPHASE_NAME_LANGUAGE MOONPHASE_TEXT_GERMAN 	// Valid values: MOONPHASE_TEXT_ENGLISH, MOONPHASE_TEXT_GERMAN, MOONPHASE_TEXT_FRENCH
 #define day_month_x day_month_day_first 				// Valid values: day_month_month_first, day_month_day_first
 #define TRANSLATION_CW "KW%V" 							// Translation for the calendar week (e.g. "CW%V")
+#define TRANSLATION_CIVIL_TWILIGHT "Buerg." 			// Detail screen: civil twilight (e.g. "Civil")
+#define TRANSLATION_NAUTICAL_TWILIGHT "Naut." 			// Detail screen: nautical twilight (e.g. "Naut.")
+#define TRANSLATION_DAY_LENGTH "Tag" 					// Detail screen: day length (e.g. "Day")
+#define TRANSLATION_FULL_MOON "VM" 						// Detail screen: next full moon (e.g. "FM")
+#define TRANSLATION_DATE "%d.%m." 						// Detail screen: date format (e.g. "%m/%d")
 
 // ----- Additional time zones to display on the top right
 #define AdditionalTimezone_1 -7 						// Timezone offest
 static char AdditionalTimezone_1_Description[] = "CDT"; // Timezone name to display
 // ----- Additional time zones to display on the top right
 
+// ----- Night mode: freeze time zone, moon, CW and sunrise/sunset overnight
+#define NIGHT_MODE NIGHT_MODE_OFF 						// Valid values: NIGHT_MODE_OFF, NIGHT_MODE_SUN, NIGHT_MODE_FIXED
+#define NIGHT_START_HOUR 23 							// Start of the night (only for NIGHT_MODE_FIXED)
+#define NIGHT_END_HOUR 6 								// End of the night (only for NIGHT_MODE_FIXED)
+// ----- Night mode
+
+// ----- Detail screen with twilights, day length and next full moon
+#define DETAIL_SCREEN 0 								// 1 = install as app and open the detail screen with the select button
+// ----- Detail screen
+
+
+// ---- Constants for the night mode ---------------------------------------------------
+
+#define NIGHT_MODE_OFF   0 	// Always update all fields
+#define NIGHT_MODE_SUN   1 	// Night lasts from sunset to sunrise
+#define NIGHT_MODE_FIXED 2 	// Night lasts from NIGHT_START_HOUR to NIGHT_END_HOUR
 
 // ---- Constants for all available languages ----------------------------------------
 
@@ -13,7 +13,11 @@ PBL_APP_INFO(MY_UUID,
 	     "90 Hank", "Hank",
 	     0, 5, /* App major/minor version */
 	     RESOURCE_ID_IMAGE_MENU_ICON,
+#if DETAIL_SCREEN
+	     APP_INFO_STANDARD_APP);
+#else
 	     APP_INFO_WATCH_FACE);
+#endif
 
 Window window;
 
@@ -31,6 +35,7 @@ TextLayer DayOfWeekLayer;
 BmpContainer background_image;
 
 BmpContainer time_format_image;
+int time_format_shown;
 
 const int DATENUM_IMAGE_RESOURCE_IDS[] = {
   RESOURCE_ID_IMAGE_DATENUM_0,
@@ -47,6 +52,7 @@ const int DATENUM_IMAGE_RESOURCE_IDS[] = {
 
 #define TOTAL_MOON_DIGITS 1
 BmpContainer moon_digits_images[TOTAL_MOON_DIGITS];
+int moon_digits_shown[TOTAL_MOON_DIGITS];
 
 const int MOON_IMAGE_RESOURCE_IDS[] = {
   RESOURCE_ID_IMAGE_MOON_0,
@@ -61,6 +67,7 @@ const int MOON_IMAGE_RESOURCE_IDS[] = {
 
 #define TOTAL_DATE_DIGITS 8
 BmpContainer date_digits_images[TOTAL_DATE_DIGITS];
+int date_digits_shown[TOTAL_DATE_DIGITS];
 
 const int BIG_DIGIT_IMAGE_RESOURCE_IDS[] = {
   RESOURCE_ID_IMAGE_NUM_0,
@@ -77,6 +84,7 @@ const int BIG_DIGIT_IMAGE_RESOURCE_IDS[] = {
 
 #define TOTAL_TIME_DIGITS 4
 BmpContainer time_digits_images[TOTAL_TIME_DIGITS];
+int time_digits_shown[TOTAL_TIME_DIGITS];
 
 void set_container_image(BmpContainer *bmp_container, const int resource_id, GPoint origin) {
   layer_remove_from_parent(&bmp_container->layer.layer);
@@ -92,6 +100,15 @@ void set_container_image(BmpContainer *bmp_container, const int resource_id, GPo
   layer_add_child(&window.layer, &bmp_container->layer.layer);
 }
 
+// Only reloads the image if it differs from the one last drawn (-1 = none)
+void update_container_image(BmpContainer *bmp_container, int *shown_id, const int resource_id, GPoint origin) {
+  if (*shown_id == resource_id) {
+    return;
+  }
+  set_container_image(bmp_container, resource_id, origin);
+  *shown_id = resource_id;
+}
+
 unsigned short get_display_hour(unsigned short hour) {
   if (clock_is_24h_style()) {
     return hour;
@@ -138,6 +155,43 @@ void adjustTimezone(float* time)
   if (*time < 0) *time += 24;
 }
 
+// Last computed sunrise/sunset in local hours, used by the night mode
+float sunrise_hour = 0;
+float sunset_hour = 0;
+bool sun_window_valid = false;
+
+// Returns SUN_NEVER_RISES/SUN_NEVER_SETS if the sun does not cross the zenith that day
+int calcSunWindow(PblTm *pblTime, float zenith, float *sunriseTime, float *sunsetTime)
+{
+	*sunriseTime = calcSunRise(pblTime->tm_year, pblTime->tm_mon+1, pblTime->tm_mday, LATITUDE, LONGITUDE, zenith);
+	*sunsetTime = calcSunSet(pblTime->tm_year, pblTime->tm_mon+1, pblTime->tm_mday, LATITUDE, LONGITUDE, zenith);
+	adjustTimezone(sunriseTime);
+	adjustTimezone(sunsetTime);
+
+	if (!pblTime->tm_isdst) 
+	{
+	  *sunriseTime+=1;
+	  *sunsetTime+=1;
+	} 
+	return calcSunState(pblTime->tm_year, pblTime->tm_mon+1, pblTime->tm_mday, LATITUDE, LONGITUDE, zenith);
+}
+
+void formatHour(char *text, size_t size, const char *time_format, float hour, PblTm *pblTime)
+{
+	pblTime->tm_min = (int)(60*(hour-((int)(hour))));
+	pblTime->tm_hour = (int)hour;
+	string_format_time(text, size, time_format, pblTime);
+}
+
+const char *getTimeFormat()
+{
+	if (clock_is_24h_style()) 
+	{
+	  return "%R";
+	} 
+	return "%I:%M";
+}
+
 void updateSunsetSunrise()
 {
 	// Calculating Sunrise/sunset with courtesy of Michael Ehrmann
@@ -148,61 +202,97 @@ void updateSunsetSunrise()
 	PblTm pblTime;
 	get_time(&pblTime);
 
-	char *time_format;
+	const char *time_format = getTimeFormat();
 
-	if (clock_is_24h_style()) 
-	{
-	  time_format = "%R";
-	} 
-	else 
-	{
-	  time_format = "%I:%M";
-	}
-
-	float sunriseTime = calcSunRise(pblTime.tm_year, pblTime.tm_mon+1, pblTime.tm_mday, LATITUDE, LONGITUDE, 91.0f);
-	float sunsetTime = calcSunSet(pblTime.tm_year, pblTime.tm_mon+1, pblTime.tm_mday, LATITUDE, LONGITUDE, 91.0f);
-	adjustTimezone(&sunriseTime);
-	adjustTimezone(&sunsetTime);
+	float sunriseTime;
+	float sunsetTime;
+	calcSunWindow(&pblTime, 91.0f, &sunriseTime, &sunsetTime);
 
-	if (!pblTime.tm_isdst) 
-	{
-	  sunriseTime+=1;
-	  sunsetTime+=1;
-	} 
+	sunrise_hour = sunriseTime;
+	sunset_hour = sunsetTime;
+	sun_window_valid = true;
 
-	pblTime.tm_min = (int)(60*(sunriseTime-((int)(sunriseTime))));
-	pblTime.tm_hour = (int)sunriseTime;
-	string_format_time(sunrise_text, sizeof(sunrise_text), time_format, &pblTime);
+	formatHour(sunrise_text, sizeof(sunrise_text), time_format, sunriseTime, &pblTime);
 	text_layer_set_text(&text_sunrise_layer, sunrise_text);
 
-	pblTime.tm_min = (int)(60*(sunsetTime-((int)(sunsetTime))));
-	pblTime.tm_hour = (int)sunsetTime;
-	string_format_time(sunset_text, sizeof(sunset_text), time_format, &pblTime);
+	formatHour(sunset_text, sizeof(sunset_text), time_format, sunsetTime, &pblTime);
 	text_layer_set_text(&text_sunset_layer, sunset_text);
 }
 
+bool is_in_window(float now, float start, float end)
+{
+  if (start > end) {
+    // Window wraps around midnight
+    return now >= start || now < end;
+  }
+  return now >= start && now < end;
+}
+
+bool is_night_time(PblTm *current_time)
+{
+  float now = current_time->tm_hour + current_time->tm_min / 60.0f;
+
+  if (NIGHT_MODE == NIGHT_MODE_FIXED) {
+    return is_in_window(now, NIGHT_START_HOUR, NIGHT_END_HOUR);
+  }
+  if (NIGHT_MODE == NIGHT_MODE_SUN && sun_window_valid) {
+    return is_in_window(now, sunset_hour, sunrise_hour);
+  }
+  return false;
+}
+
+void update_timezone(unsigned short display_hour, PblTm *current_time) {
+  short  display_hour_tz1 = display_hour AdditionalTimezone_1;
+  if (display_hour_tz1 > 24) display_hour_tz1 -= 24;
+  if (display_hour_tz1 < 0) display_hour_tz1 += 24;
+  update_container_image(&date_digits_images[4], &date_digits_shown[4], DATENUM_IMAGE_RESOURCE_IDS[display_hour_tz1/10], GPoint(75, 5));
+  update_container_image(&date_digits_images[5], &date_digits_shown[5], DATENUM_IMAGE_RESOURCE_IDS[display_hour_tz1%10], GPoint(88, 5));  
+  update_container_image(&date_digits_images[6], &date_digits_shown[6], DATENUM_IMAGE_RESOURCE_IDS[current_time->tm_min/10], GPoint(108, 5));
+  update_container_image(&date_digits_images[7], &date_digits_shown[7], DATENUM_IMAGE_RESOURCE_IDS[current_time->tm_min%10], GPoint(121, 5));  
+}
+
+void update_secondary(PblTm *current_time) {
+	// -------------------- Moon_phase
+	  int moonphase_number;
+	  moonphase_number = moon_phase(current_time->tm_year+1900,current_time->tm_mon,current_time->tm_mday);
+
+	  update_container_image(&moon_digits_images[0], &moon_digits_shown[0], MOON_IMAGE_RESOURCE_IDS[moonphase_number], GPoint(1, 1));  // ---------- Moon phase Image
+
+
+
+	  text_layer_set_text(&moonLayer, MOONPHASE_NAME_LANGUAGE[moonphase_number]);
+	// -------------------- Moon_phase
+	  
+	// -------------------- Calendar week  
+	  static char cw_text[] = "XX00";
+	  string_format_time(cw_text, sizeof(cw_text), TRANSLATION_CW , current_time);
+	  text_layer_set_text(&cwLayer, cw_text); 
+	// ------------------- Calendar week  
+	updateSunsetSunrise();
+}
+
 unsigned short the_last_hour = 25;
 
+// Set when the hourly fields changed while the night mode held them back
+bool secondary_stale = false;
+
 void update_display(PblTm *current_time) {
   
   unsigned short display_hour = get_display_hour(current_time->tm_hour);
+  // The first draw paints every field, the night mode only freezes them afterwards
+  bool night = the_last_hour != 25 && is_night_time(current_time);
   
   //Hour
-  set_container_image(&time_digits_images[0], BIG_DIGIT_IMAGE_RESOURCE_IDS[display_hour/10], GPoint(4, 94));
-  set_container_image(&time_digits_images[1], BIG_DIGIT_IMAGE_RESOURCE_IDS[display_hour%10], GPoint(37, 94));
+  update_container_image(&time_digits_images[0], &time_digits_shown[0], BIG_DIGIT_IMAGE_RESOURCE_IDS[display_hour/10], GPoint(4, 94));
+  update_container_image(&time_digits_images[1], &time_digits_shown[1], BIG_DIGIT_IMAGE_RESOURCE_IDS[display_hour%10], GPoint(37, 94));
   //Minute
-  set_container_image(&time_digits_images[2], BIG_DIGIT_IMAGE_RESOURCE_IDS[current_time->tm_min/10], GPoint(80, 94));
-  set_container_image(&time_digits_images[3], BIG_DIGIT_IMAGE_RESOURCE_IDS[current_time->tm_min%10], GPoint(111, 94));
+  update_container_image(&time_digits_images[2], &time_digits_shown[2], BIG_DIGIT_IMAGE_RESOURCE_IDS[current_time->tm_min/10], GPoint(80, 94));
+  update_container_image(&time_digits_images[3], &time_digits_shown[3], BIG_DIGIT_IMAGE_RESOURCE_IDS[current_time->tm_min%10], GPoint(111, 94));
   
   // ======== Time Zone 1  
-  text_layer_set_text(&text_addTimeZone1_layer, AdditionalTimezone_1_Description); 
-  short  display_hour_tz1 = display_hour AdditionalTimezone_1;
-  if (display_hour_tz1 > 24) display_hour_tz1 -= 24;
-  if (display_hour_tz1 < 0) display_hour_tz1 += 24;
-  set_container_image(&date_digits_images[4], DATENUM_IMAGE_RESOURCE_IDS[display_hour_tz1/10], GPoint(75, 5));
-  set_container_image(&date_digits_images[5], DATENUM_IMAGE_RESOURCE_IDS[display_hour_tz1%10], GPoint(88, 5));  
-  set_container_image(&date_digits_images[6], DATENUM_IMAGE_RESOURCE_IDS[current_time->tm_min/10], GPoint(108, 5));
-  set_container_image(&date_digits_images[7], DATENUM_IMAGE_RESOURCE_IDS[current_time->tm_min%10], GPoint(121, 5));  
+  if (!night) {
+	  update_timezone(display_hour, current_time);
+  }
   // ======== Time Zone 1  
   
   
@@ -213,51 +303,286 @@ void update_display(PblTm *current_time) {
 	  text_layer_set_text(&DayOfWeekLayer, DAY_NAME_LANGUAGE[current_time->tm_wday]); 
 	
 	  // Day
-	  set_container_image(&date_digits_images[0], DATENUM_IMAGE_RESOURCE_IDS[current_time->tm_mday/10], GPoint(day_month_x[0], 71));
-	  set_container_image(&date_digits_images[1], DATENUM_IMAGE_RESOURCE_IDS[current_time->tm_mday%10], GPoint(day_month_x[0] + 13, 71));
+	  update_container_image(&date_digits_images[0], &date_digits_shown[0], DATENUM_IMAGE_RESOURCE_IDS[current_time->tm_mday/10], GPoint(day_month_x[0], 71));
+	  update_container_image(&date_digits_images[1], &date_digits_shown[1], DATENUM_IMAGE_RESOURCE_IDS[current_time->tm_mday%10], GPoint(day_month_x[0] + 13, 71));
 	 
 	  // Month
-	  set_container_image(&date_digits_images[2], DATENUM_IMAGE_RESOURCE_IDS[(current_time->tm_mon+1)/10], GPoint(day_month_x[1], 71));
-	  set_container_image(&date_digits_images[3], DATENUM_IMAGE_RESOURCE_IDS[(current_time->tm_mon+1)%10], GPoint(day_month_x[1] + 13, 71));
+	  update_container_image(&date_digits_images[2], &date_digits_shown[2], DATENUM_IMAGE_RESOURCE_IDS[(current_time->tm_mon+1)/10], GPoint(day_month_x[1], 71));
+	  update_container_image(&date_digits_images[3], &date_digits_shown[3], DATENUM_IMAGE_RESOURCE_IDS[(current_time->tm_mon+1)%10], GPoint(day_month_x[1] + 13, 71));
 
 	  if (!clock_is_24h_style()) {
 		if (current_time->tm_hour >= 12) {
-		  set_container_image(&time_format_image, RESOURCE_ID_IMAGE_PM_MODE, GPoint(10, 78));
+		  update_container_image(&time_format_image, &time_format_shown, RESOURCE_ID_IMAGE_PM_MODE, GPoint(10, 78));
 		} else {
 		  layer_remove_from_parent(&time_format_image.layer.layer);
 		  bmp_deinit_container(&time_format_image);
+		  time_format_shown = -1;
 		}
 
 		if (display_hour/10 == 0) {
 		  layer_remove_from_parent(&time_digits_images[0].layer.layer);
 		  bmp_deinit_container(&time_digits_images[0]);
+		  time_digits_shown[0] = -1;
 		}
 	  }
-		 
-	// -------------------- Moon_phase
-	  int moonphase_number;
-	  moonphase_number = moon_phase(current_time->tm_year+1900,current_time->tm_mon,current_time->tm_mday);
 
-	  set_container_image(&moon_digits_images[0], MOON_IMAGE_RESOURCE_IDS[moonphase_number], GPoint(1, 1));  // ---------- Moon phase Image
+	the_last_hour = display_hour;
+	secondary_stale = true;
+  }
 
+  // Moon, calendar week and sunrise/sunset wait until the night is over
+  // and are then caught up in a single redraw.
+  if (secondary_stale && !night) {
+	update_secondary(current_time);
+	secondary_stale = false;
+  }
+}
 
 
-	  text_layer_set_text(&moonLayer, MOONPHASE_NAME_LANGUAGE[moonphase_number]);
-	// -------------------- Moon_phase
-	  
-	// -------------------- Calendar week  
-	  static char cw_text[] = "XX00";
-	  string_format_time(cw_text, sizeof(cw_text), TRANSLATION_CW , current_time);
-	  text_layer_set_text(&cwLayer, cw_text); 
-	// ------------------- Calendar week  
-	the_last_hour = display_hour;
-	updateSunsetSunrise();
+// ======== Detail screen
+// Twilights, day length and next full moon are only computed when the
+// screen is opened and are then kept until the day changes.
+#if DETAIL_SCREEN
+
+Window detail_window;
+
+TextLayer detail_layer;
+
+static char detail_text[96];
+bool detail_open = false;
+int detail_cache_yday = -1;
+int detail_cache_year = -1;
+
+bool is_leap_year(int year)
+{
+  return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+}
+
+int days_in_month(int year, int mon)
+{
+  static const int DAYS[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+  if (mon == 1 && is_leap_year(year)) {
+    return 29;
+  }
+  return DAYS[mon];
+}
+
+void step_day(PblTm *date)
+{
+  date->tm_mday++;
+  if (date->tm_mday > days_in_month(date->tm_year+1900, date->tm_mon)) {
+    date->tm_mday = 1;
+    date->tm_mon++;
+    if (date->tm_mon > 11) {
+      date->tm_mon = 0;
+      date->tm_year++;
+    }
+  }
+}
+
+// Mean lunation after Meeus, "Astronomical Algorithms" ch. 49: new moon k = 0
+// falls 5.59766 days after 2000-01-01 00:00 UT.
+#define LUNATION_EPOCH 5.59766
+#define SYNODIC_MONTH 29.530588861
+
+float lunation_angle(double base, double rate, double k)
+{
+  double angle = base + rate * k;
+  angle -= 360.0 * (int)(angle / 360.0);
+  if (angle < 0) angle += 360.0;
+  return (M_PI/180.0f) * angle;
+}
+
+void next_full_moon(PblTm *date)
+{
+  // The moon's own age is used here, not the 8 step moon_phase() of the main
+  // screen, which is only accurate to a couple of days.
+  int days = date->tm_yday;
+  for (int year = 2000; year < date->tm_year+1900; year++) {
+    days += is_leap_year(year) ? 366 : 365;
+  }
+  double now = days - TIMEZONE / 24.0;  // Local midnight in UT
+
+  // Full moons are the lunations k + 0.5; start one before the current one
+  double k = (int)((now - LUNATION_EPOCH) / SYNODIC_MONTH) - 0.5;
+  double full_moon;
+  for (;;) {
+    full_moon = LUNATION_EPOCH + SYNODIC_MONTH * k;
+
+    // Largest periodic terms, leaves an error of about an hour
+    float M  = lunation_angle(2.5534, 29.1053567, k);
+    float Mp = lunation_angle(201.5643, 385.81693528, k);
+    float F  = lunation_angle(160.7108, 390.67050284, k);
+    full_moon += - 0.40614 * my_sin(Mp)
+                 + 0.17302 * my_sin(M)
+                 + 0.01614 * my_sin(2 * Mp)
+                 + 0.01043 * my_sin(2 * F)
+                 + 0.00734 * my_sin(Mp - M)
+                 - 0.00515 * my_sin(Mp + M)
+                 + 0.00209 * my_sin(2 * M);
+
+    if (full_moon >= now) {
+      break;
+    }
+    k += 1;
+  }
+
+  for (int i = (int)(full_moon - now); i > 0; i--) {
+    step_day(date);
+  }
+}
+
+void append_sun_window(char *text, const char *label, float zenith, PblTm *pblTime)
+{
+  static char hour_text[] = "00:00";
+  const char *time_format = getTimeFormat();
+  float riseTime;
+  float setTime;
+
+  strcat(text, label);
+  strcat(text, " ");
+  if (calcSunWindow(pblTime, zenith, &riseTime, &setTime) != SUN_RISES_AND_SETS) {
+    strcat(text, "--\n");
+    return;
+  }
+  formatHour(hour_text, sizeof(hour_text), time_format, riseTime, pblTime);
+  strcat(text, hour_text);
+  strcat(text, "-");
+  formatHour(hour_text, sizeof(hour_text), time_format, setTime, pblTime);
+  strcat(text, hour_text);
+  strcat(text, "\n");
+}
+
+// Returns true if the text was rebuilt for a new day
+bool update_detail_text(PblTm *current_time)
+{
+  PblTm pblTime = *current_time;
+
+  if (detail_cache_yday == pblTime.tm_yday && detail_cache_year == pblTime.tm_year) {
+    return false;
+  }
+
+  static char value_text[] = "00:00";
+  static char date_text[12];
+  PblTm scratch = pblTime;
+
+  detail_text[0] = '\0';
+  append_sun_window(detail_text, TRANSLATION_CIVIL_TWILIGHT, ZENITH_CIVIL, &scratch);
+  append_sun_window(detail_text, TRANSLATION_NAUTICAL_TWILIGHT, ZENITH_NAUTICAL, &scratch);
+
+  // Day length from the same sunrise/sunset as the main screen
+  float sunriseTime;
+  float sunsetTime;
+  int sun_state = calcSunWindow(&scratch, 91.0f, &sunriseTime, &sunsetTime);
+  if (sun_state == SUN_NEVER_SETS) {
+    strcpy(value_text, "24:00");
+  } else if (sun_state == SUN_NEVER_RISES) {
+    strcpy(value_text, "00:00");
+  } else {
+    float day_length = sunsetTime - sunriseTime;
+    if (day_length < 0) day_length += 24;
+    formatHour(value_text, sizeof(value_text), "%H:%M", day_length, &scratch);
+  }
+  strcat(detail_text, TRANSLATION_DAY_LENGTH " ");
+  strcat(detail_text, value_text);
+  strcat(detail_text, "\n");
+
+  scratch = pblTime;
+  next_full_moon(&scratch);
+  string_format_time(date_text, sizeof(date_text), TRANSLATION_DATE, &scratch);
+  strcat(detail_text, TRANSLATION_FULL_MOON " ");
+  strcat(detail_text, date_text);
+
+  detail_cache_yday = pblTime.tm_yday;
+  detail_cache_year = pblTime.tm_year;
+  return true;
+}
+
+void detail_window_load(Window *me) {
+  PblTm pblTime;
+  get_time(&pblTime);
+  update_detail_text(&pblTime);
+  detail_open = true;
+
+  text_layer_init(&detail_layer, GRect(4, 4, 136 /* width */, 160 /* height */));
+  text_layer_set_text_color(&detail_layer, GColorWhite);
+  text_layer_set_background_color(&detail_layer, GColorClear);
+  text_layer_set_font(&detail_layer, fonts_get_system_font(FONT_KEY_GOTHIC_18));
+  text_layer_set_text(&detail_layer, detail_text);
+  layer_add_child(&me->layer, &detail_layer.layer);
+}
+
+void detail_window_unload(Window *me) {
+  (void)me;
+
+  detail_open = false;
+  layer_remove_from_parent(&detail_layer.layer);
+}
+
+void show_detail_window() {
+  window_init(&detail_window, "90 Hank Details");
+  window_set_background_color(&detail_window, GColorBlack);
+  window_set_window_handlers(&detail_window, (WindowHandlers){
+    .load = detail_window_load,
+    .unload = detail_window_unload
+  });
+  window_stack_push(&detail_window, true /* Animated */);
+}
+
+void select_single_click_handler(ClickRecognizerRef recognizer, Window *window) {
+  (void)recognizer;
+  (void)window;
+
+  show_detail_window();
+}
+
+void click_config_provider(ClickConfig **config, Window *window) {
+  (void)window;
+
+  config[BUTTON_ID_SELECT]->click.handler = (ClickHandler) select_single_click_handler;
+}
+#endif
+// ======== Detail screen
+
+
+// While the face is covered (notification, detail screen) ticks are only
+// recorded and caught up in one update when it appears again.
+bool face_visible = true;
+bool tick_pending = false;
+PblTm pending_tick_time;
+
+void window_appear(Window *me) {
+  (void)me;
+
+  face_visible = true;
+  if (tick_pending) {
+    tick_pending = false;
+    update_display(&pending_tick_time);
   }
 }
 
+void window_disappear(Window *me) {
+  (void)me;
+
+  face_visible = false;
+}
 
 void handle_minute_tick(AppContextRef ctx, PebbleTickEvent *t) {
   (void)ctx;
+
+#if DETAIL_SCREEN
+  // An open detail screen switches to the new day's values at midnight
+  if (detail_open && update_detail_text(t->tick_time)) {
+    text_layer_set_text(&detail_layer, detail_text);
+  }
+#endif
+
+  if (!face_visible) {
+    pending_tick_time = *t->tick_time;
+    tick_pending = true;
+    return;
+  }
   update_display(t->tick_time);
 }
 
@@ -266,12 +591,30 @@ void handle_init(AppContextRef ctx) {
   (void)ctx;
 
   window_init(&window, "90 Hank");
+  window_set_window_handlers(&window, (WindowHandlers){
+    .appear = window_appear,
+    .disappear = window_disappear
+  });
   window_stack_push(&window, true /* Animated */);
+#if DETAIL_SCREEN
+  window_set_click_config_provider(&window, (ClickConfigProvider) click_config_provider);
+#endif
   
   window_set_background_color(&window, GColorBlack);
   
   resource_init_current_app(&APP_RESOURCES);
 
+  time_format_shown = -1;
+  for (int i = 0; i < TOTAL_DATE_DIGITS; i++) {
+    date_digits_shown[i] = -1;
+  }
+  for (int i = 0; i < TOTAL_MOON_DIGITS; i++) {
+    moon_digits_shown[i] = -1;
+  }
+  for (int i = 0; i < TOTAL_TIME_DIGITS; i++) {
+    time_digits_shown[i] = -1;
+  }
+
   bmp_init_container(RESOURCE_ID_IMAGE_BACKGROUND, &background_image);
   layer_add_child(&window.layer, &background_image.layer.layer);
 
@@ -322,6 +665,7 @@ void handle_init(AppContextRef ctx) {
   layer_set_frame(&text_addTimeZone1_layer.layer, GRect(51, 6, 100, 30));
   text_layer_set_font(&text_addTimeZone1_layer, fonts_get_system_font(FONT_KEY_GOTHIC_14));
   layer_add_child(&window.layer, &text_addTimeZone1_layer.layer);  
+  text_layer_set_text(&text_addTimeZone1_layer, AdditionalTimezone_1_Description); 
   
   
   // Day of week text
@@ -5,7 +5,8 @@
 #include "suncalc.h"
 #include "my_math.h"
 
-float calcSun(int year, int month, int day, float latitude, float longitude, int sunset, float zenith)
+// Steps 1 to 7a, shared by calcSun() and calcSunState()
+static float calcCosH(int year, int month, int day, float latitude, float longitude, int sunset, float zenith, float *tOut, float *RAOut)
 {
   int N1 = my_floor(275 * month / 9);
   int N2 = my_floor((month + 9) / 12);
@@ -55,6 +56,18 @@ float calcSun(int year, int month, int day, float latitude, float longitude, int
   //7a. calculate the Sun's local hour angle
   //cosH = (cos(zenith) - (sinDec * sin(latitude))) / (cosDec * cos(latitude))
   float cosH = (my_cos((M_PI/180.0f) * zenith) - (sinDec * my_sin((M_PI/180.0f) * latitude))) / (cosDec * my_cos((M_PI/180.0f) * latitude));
+
+  *tOut = t;
+  *RAOut = RA;
+  return cosH;
+}
+
+float calcSun(int year, int month, int day, float latitude, float longitude, int sunset, float zenith)
+{
+  float lngHour = longitude / 15;
+  float t;
+  float RA;
+  float cosH = calcCosH(year, month, day, latitude, longitude, sunset, zenith, &t, &RA);
   
   if (cosH >  1) {
     return 0;
@@ -99,4 +112,15 @@ float calcSunRise(int year, int month, int day, float latitude, float longitude,
 float calcSunSet(int year, int month, int day, float latitude, float longitude, float zenith)
 {
   return calcSun(year, month, day, latitude, longitude, 1, zenith);
+}
+
+int calcSunState(int year, int month, int day, float latitude, float longitude, float zenith)
+{
+  float t;
+  float RA;
+  float cosH = calcCosH(year, month, day, latitude, longitude, 0, zenith, &t, &RA);
+
+  if (cosH > 1) return SUN_NEVER_RISES;
+  if (cosH < -1) return SUN_NEVER_SETS;
+  return SUN_RISES_AND_SETS;
 }
\ No newline at end of file
@@ -3,6 +3,12 @@
 #define ZENITH_NAUTICAL 102.0
 #define ZENITH_ASTRONOMICAL 108.0
 
+// Results of calcSunState(); calcSun() returns 0 in both polar cases
+#define SUN_RISES_AND_SETS 0
+#define SUN_NEVER_RISES    1
+#define SUN_NEVER_SETS     2
+
 float calcSun(int year, int month, int day, float latitude, float longitude, int sunset, float zenith);
 float calcSunRise(int year, int month, int day, float latitude, float longitude, float zenith);
-float calcSunSet(int year, int month, int day, float latitude, float longitude, float zenith);
\ No newline at end of file
+float calcSunSet(int year, int month, int day, float latitude, float longitude, float zenith);
+int calcSunState(int year, int month, int day, float latitude, float longitude, float zenith);
\ No newline at end of file